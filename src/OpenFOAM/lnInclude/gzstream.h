@@ -0,0 +1 @@
+../db/IOstreams/gzstream/gzstream.h
\ No newline at end of file
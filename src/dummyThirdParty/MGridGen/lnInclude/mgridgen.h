@@ -0,0 +1 @@
+../mgridgen.h
\ No newline at end of file
@@ -0,0 +1 @@
+../metis.h
\ No newline at end of file